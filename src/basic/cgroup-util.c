@@ -729,6 +729,25 @@ int cg_remove_xattr(const char *path, const char *name) {
         return RET_NERRNO(removexattr(fs, name));
 }
 
+static int cg_pid_path_dup(const char *p, char **ret_path) {
+        char *path, *e;
+
+        assert(p);
+        assert(ret_path);
+
+        path = strdup(p);
+        if (!path)
+                return -ENOMEM;
+
+        /* Truncate suffix indicating the process is a zombie */
+        e = endswith(path, " (deleted)");
+        if (e)
+                *e = 0;
+
+        *ret_path = path;
+        return 0;
+}
+
 int cg_pid_get_path(const char *controller, pid_t pid, char **ret_path) {
         _cleanup_fclose_ FILE *f = NULL;
         const char *fs, *controller_str = NULL;  /* avoid false maybe-uninitialized warning */
@@ -754,6 +773,29 @@ int cg_pid_get_path(const char *controller, pid_t pid, char **ret_path) {
         }
 
         fs = procfs_file_alloca(pid, "cgroup");
+
+        if (unified) {
+                _cleanup_free_ char *content = NULL;
+                char *p;
+
+                /* This is called a lot by PID 1 to map processes to units (e.g. for every sd_notify()
+                 * message), hence read the file in one go rather than line by line via stdio. On the unified
+                 * hierarchy we are only interested in the single "0::" line anyway. */
+                r = read_full_virtual_file(fs, &content, NULL);
+                if (r == -ENOENT)
+                        return -ESRCH;
+                if (r < 0)
+                        return r;
+
+                p = find_line_startswith(content, "0::");
+                if (!p)
+                        return -ENODATA;
+
+                p[strcspn(p, NEWLINE)] = 0;
+
+                return cg_pid_path_dup(p, ret_path);
+        }
+
         r = fopen_unlocked(fs, "re", &f);
         if (r == -ENOENT)
                 return -ESRCH;
@@ -762,54 +804,32 @@ int cg_pid_get_path(const char *controller, pid_t pid, char **ret_path) {
 
         for (;;) {
                 _cleanup_free_ char *line = NULL;
-                char *e;
+                char *e, *l;
 
-                r = read_line(f, LONG_LINE_MAX, &line);
+                r = read_line_full(f, LONG_LINE_MAX, READ_LINE_NOT_A_TTY, &line);
                 if (r < 0)
                         return r;
                 if (r == 0)
                         return -ENODATA;
 
-                if (unified) {
-                        e = startswith(line, "0:");
-                        if (!e)
-                                continue;
-
-                        e = strchr(e, ':');
-                        if (!e)
-                                continue;
-                } else {
-                        char *l;
-
-                        l = strchr(line, ':');
-                        if (!l)
-                                continue;
-
-                        l++;
-                        e = strchr(l, ':');
-                        if (!e)
-                                continue;
-                        *e = 0;
-
-                        assert(controller_str);
-                        r = string_contains_word(l, ",", controller_str);
-                        if (r < 0)
-                                return r;
-                        if (r == 0)
-                                continue;
-                }
+                l = strchr(line, ':');
+                if (!l)
+                        continue;
 
-                char *path = strdup(e + 1);
-                if (!path)
-                        return -ENOMEM;
+                l++;
+                e = strchr(l, ':');
+                if (!e)
+                        continue;
+                *e = 0;
 
-                /* Truncate suffix indicating the process is a zombie */
-                e = endswith(path, " (deleted)");
-                if (e)
-                        *e = 0;
+                assert(controller_str);
+                r = string_contains_word(l, ",", controller_str);
+                if (r < 0)
+                        return r;
+                if (r == 0)
+                        continue;
 
-                *ret_path = path;
-                return 0;
+                return cg_pid_path_dup(e + 1, ret_path);
         }
 }
 
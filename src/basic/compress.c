@@ -54,12 +54,13 @@ DEFINE_TRIVIAL_CLEANUP_FUNC_FULL(LZ4F_decompressionContext_t, sym_LZ4F_freeDecom
 static void *zstd_dl = NULL;
 
 static DLSYM_PROTOTYPE(ZSTD_CCtx_setParameter) = NULL;
-static DLSYM_PROTOTYPE(ZSTD_compress) = NULL;
+static DLSYM_PROTOTYPE(ZSTD_compressCCtx) = NULL;
 static DLSYM_PROTOTYPE(ZSTD_compressStream2) = NULL;
 static DLSYM_PROTOTYPE(ZSTD_createCCtx) = NULL;
 static DLSYM_PROTOTYPE(ZSTD_createDCtx) = NULL;
 static DLSYM_PROTOTYPE(ZSTD_CStreamInSize) = NULL;
 static DLSYM_PROTOTYPE(ZSTD_CStreamOutSize) = NULL;
+static DLSYM_PROTOTYPE(ZSTD_DCtx_reset) = NULL;
 static DLSYM_PROTOTYPE(ZSTD_decompressStream) = NULL;
 static DLSYM_PROTOTYPE(ZSTD_DStreamInSize) = NULL;
 static DLSYM_PROTOTYPE(ZSTD_DStreamOutSize) = NULL;
@@ -73,6 +74,56 @@ static DLSYM_PROTOTYPE(ZSTD_isError) = NULL;
 DEFINE_TRIVIAL_CLEANUP_FUNC_FULL(ZSTD_CCtx*, sym_ZSTD_freeCCtx, NULL);
 DEFINE_TRIVIAL_CLEANUP_FUNC_FULL(ZSTD_DCtx*, sym_ZSTD_freeDCtx, NULL);
 
+/* Allocating and initializing a (de)compression context is expensive compared to (de)compressing the small
+ * blobs we typically deal with, e.g. journal data objects, which are compressed one by one. Hence, keep one
+ * context of each kind around for reuse. A context is taken out of the cache while in use, so that
+ * concurrent users in other threads simply allocate their own, and whatever is put back last stays. */
+static ZSTD_CCtx *cached_cctx = NULL;
+static ZSTD_DCtx *cached_dctx = NULL;
+
+static ZSTD_CCtx* zstd_cctx_acquire(void) {
+        ZSTD_CCtx *c;
+
+        c = __atomic_exchange_n(&cached_cctx, NULL, __ATOMIC_ACQ_REL);
+        if (c)
+                return c;
+
+        return sym_ZSTD_createCCtx();
+}
+
+static void zstd_cctx_release(ZSTD_CCtx *c) {
+        if (!c)
+                return;
+
+        sym_ZSTD_freeCCtx(__atomic_exchange_n(&cached_cctx, c, __ATOMIC_ACQ_REL));
+}
+
+static ZSTD_DCtx* zstd_dctx_acquire(void) {
+        ZSTD_DCtx *d;
+
+        d = __atomic_exchange_n(&cached_dctx, NULL, __ATOMIC_ACQ_REL);
+        if (d) {
+                /* The previous user might have stopped in the middle of a frame, start afresh. Resetting
+                 * only the session can't really fail, but if it does, don't reuse the context. */
+                if (!sym_ZSTD_isError(sym_ZSTD_DCtx_reset(d, ZSTD_reset_session_only)))
+                        return d;
+
+                sym_ZSTD_freeDCtx(d);
+        }
+
+        return sym_ZSTD_createDCtx();
+}
+
+static void zstd_dctx_release(ZSTD_DCtx *d) {
+        if (!d)
+                return;
+
+        sym_ZSTD_freeDCtx(__atomic_exchange_n(&cached_dctx, d, __ATOMIC_ACQ_REL));
+}
+
+DEFINE_TRIVIAL_CLEANUP_FUNC_FULL(ZSTD_CCtx*, zstd_cctx_release, NULL);
+DEFINE_TRIVIAL_CLEANUP_FUNC_FULL(ZSTD_DCtx*, zstd_dctx_release, NULL);
+
 static int zstd_ret_to_errno(size_t ret) {
         switch (sym_ZSTD_getErrorCode(ret)) {
         case ZSTD_error_dstSize_tooSmall:
@@ -261,13 +312,14 @@ int dlopen_zstd(void) {
                         &zstd_dl,
                         "libzstd.so.1", LOG_DEBUG,
                         DLSYM_ARG(ZSTD_getErrorCode),
-                        DLSYM_ARG(ZSTD_compress),
+                        DLSYM_ARG(ZSTD_compressCCtx),
                         DLSYM_ARG(ZSTD_getFrameContentSize),
                         DLSYM_ARG(ZSTD_decompressStream),
                         DLSYM_ARG(ZSTD_getErrorName),
                         DLSYM_ARG(ZSTD_DStreamOutSize),
                         DLSYM_ARG(ZSTD_CStreamInSize),
                         DLSYM_ARG(ZSTD_CStreamOutSize),
+                        DLSYM_ARG(ZSTD_DCtx_reset),
                         DLSYM_ARG(ZSTD_CCtx_setParameter),
                         DLSYM_ARG(ZSTD_compressStream2),
                         DLSYM_ARG(ZSTD_DStreamInSize),
@@ -297,7 +349,11 @@ int compress_blob_zstd(
         if (r < 0)
                 return r;
 
-        k = sym_ZSTD_compress(dst, dst_alloc_size, src, src_size, 0);
+        _cleanup_(zstd_cctx_releasep) ZSTD_CCtx *cctx = zstd_cctx_acquire();
+        if (!cctx)
+                return -ENOMEM;
+
+        k = sym_ZSTD_compressCCtx(cctx, dst, dst_alloc_size, src, src_size, 0);
         if (sym_ZSTD_isError(k))
                 return zstd_ret_to_errno(k);
 
@@ -448,7 +504,7 @@ int decompress_blob_zstd(
         if (!(greedy_realloc(dst, MAX(sym_ZSTD_DStreamOutSize(), size), 1)))
                 return -ENOMEM;
 
-        _cleanup_(sym_ZSTD_freeDCtxp) ZSTD_DCtx *dctx = sym_ZSTD_createDCtx();
+        _cleanup_(zstd_dctx_releasep) ZSTD_DCtx *dctx = zstd_dctx_acquire();
         if (!dctx)
                 return -ENOMEM;
 
@@ -667,7 +723,7 @@ int decompress_startswith_zstd(
         if (size < prefix_len + 1)
                 return 0; /* Decompressed text too short to match the prefix and extra */
 
-        _cleanup_(sym_ZSTD_freeDCtxp) ZSTD_DCtx *dctx = sym_ZSTD_createDCtx();
+        _cleanup_(zstd_dctx_releasep) ZSTD_DCtx *dctx = zstd_dctx_acquire();
         if (!dctx)
                 return -ENOMEM;
 
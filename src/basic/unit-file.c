@@ -583,7 +583,10 @@ int unit_file_build_name_map(
                 }
         }
 
-        /* Let's also put the names in the reverse db. */
+        /* Let's also put the names in the reverse db. Aliases resolve to the very same fragment path
+         * string, hence remember which fragments we already found not to be masked, so that we stat()
+         * each of them only once. */
+        _cleanup_set_free_ Set *unmasked = NULL;
         const char *dummy, *src;
         HASHMAP_FOREACH_KEY(dummy, src, ids) {
                 _cleanup_free_ char *inst = NULL, *dst_inst = NULL;
@@ -593,8 +596,13 @@ int unit_file_build_name_map(
                 if (r < 0)
                         continue;
 
-                if (null_or_empty_path(dst) != 0)
-                        continue;
+                if (!set_contains(unmasked, dst)) {
+                        if (null_or_empty_path(dst) != 0)
+                                continue;
+
+                        if (set_ensure_put(&unmasked, NULL, dst) < 0)
+                                return log_oom();
+                }
 
                 dst = basename(dst);
 
@@ -49,6 +49,9 @@
 
 #define CGROUP_CPU_QUOTA_DEFAULT_PERIOD_USEC ((usec_t) 100 * USEC_PER_MSEC)
 
+/* How many units to process from the cgroup empty/OOM queues per event loop iteration at most */
+#define CGROUP_QUEUE_DISPATCH_MAX 64U
+
 /* Returns the log level to use when cgroup attribute writes fail. When an attribute is missing or we have access
  * problems we downgrade to LOG_DEBUG. This is supposed to be nice to container managers and kernels which want to mask
  * out specific attributes from us. */
@@ -115,6 +118,40 @@ bool unit_has_host_root_cgroup(const Unit *u) {
         return unit_has_name(u, SPECIAL_ROOT_SLICE);
 }
 
+static void cgroup_runtime_remember_attribute(CGroupRuntime *crt, const char *attribute, const char *value) {
+        _cleanup_free_ char *old_attribute = NULL;
+
+        assert(crt);
+        assert(attribute);
+
+        free(hashmap_remove2(crt->cgroup_attributes_written, attribute, (void**) &old_attribute));
+
+        /* Failing to remember the value is not fatal, we'll simply write the attribute again next time */
+        if (value)
+                (void) hashmap_put_strdup(&crt->cgroup_attributes_written, attribute, value);
+}
+
+static void cgroup_runtime_forget_attributes(CGroupRuntime *crt, CGroupMask mask) {
+        const char *attribute;
+        char *value;
+
+        assert(crt);
+
+        if (mask == 0)
+                return;
+
+        HASHMAP_FOREACH_KEY(value, attribute, crt->cgroup_attributes_written) {
+                CGroupController c;
+
+                c = cgroup_controller_from_string(strndupa_safe(attribute, strcspn(attribute, ".")));
+                if (c >= 0 && !FLAGS_SET(mask, CGROUP_CONTROLLER_TO_MASK(c)))
+                        continue;
+
+                /* Removing the current entry while iterating is fine */
+                cgroup_runtime_remember_attribute(crt, attribute, NULL);
+        }
+}
+
 static int set_attribute_and_warn(Unit *u, const char *controller, const char *attribute, const char *value) {
         int r;
 
@@ -124,11 +161,18 @@ static int set_attribute_and_warn(Unit *u, const char *controller, const char *a
         if (!crt || !crt->cgroup_path)
                 return -EOWNERDEAD;
 
+        /* Writing cgroup attributes is not free for the kernel, and when a unit's cgroup is realized again,
+         * most of them usually didn't change. Hence skip the write if we wrote the very same value last
+         * time. */
+        if (streq_ptr(hashmap_get(crt->cgroup_attributes_written, attribute), value))
+                return 0;
+
         r = cg_set_attribute(controller, crt->cgroup_path, attribute, value);
         if (r < 0)
                 log_unit_full_errno(u, LOG_LEVEL_CGROUP_WRITE(r), r, "Failed to set '%s' attribute on '%s' to '%.*s': %m",
                                     strna(attribute), empty_to_root(crt->cgroup_path), (int) strcspn(value, NEWLINE), value);
 
+        cgroup_runtime_remember_attribute(crt, attribute, r >= 0 ? value : NULL);
         return r;
 }
 
@@ -1544,10 +1588,20 @@ static void cgroup_apply_unified_cpu_idle(Unit *u, uint64_t weight) {
 
         is_idle = weight == CGROUP_WEIGHT_IDLE;
         idle_val = one_zero(is_idle);
+
+        if (streq_ptr(hashmap_get(crt->cgroup_attributes_written, "cpu.idle"), idle_val))
+                return;
+
         r = cg_set_attribute("cpu", crt->cgroup_path, "cpu.idle", idle_val);
         if (r < 0 && (r != -ENOENT || is_idle))
                 log_unit_full_errno(u, LOG_LEVEL_CGROUP_WRITE(r), r, "Failed to set '%s' attribute on '%s' to '%s': %m",
                                     "cpu.idle", empty_to_root(crt->cgroup_path), idle_val);
+
+        cgroup_runtime_remember_attribute(crt, "cpu.idle", r >= 0 ? idle_val : NULL);
+
+        /* Changing cpu.idle makes the kernel reset the group's weight behind our back (clearing it restores
+         * the default weight), hence make sure cpu.weight is written again afterwards. */
+        cgroup_runtime_remember_attribute(crt, "cpu.weight", NULL);
 }
 
 static void cgroup_apply_unified_cpu_quota(Unit *u, usec_t quota, usec_t period) {
@@ -2883,6 +2937,15 @@ static int unit_update_cgroup(
                 return log_unit_error_errno(u, r, "Failed to create cgroup %s: %m", empty_to_root(crt->cgroup_path));
         created = r;
 
+        /* A new cgroup starts out with the kernel's defaults, forget about anything we wrote before. The
+         * same applies to the files of a controller that is enabled on an existing cgroup (or whose
+         * directory is recreated on the legacy hierarchy), hence also forget about the attributes of all
+         * controllers that are added or removed now. */
+        if (created || !crt->cgroup_realized)
+                crt->cgroup_attributes_written = hashmap_free(crt->cgroup_attributes_written);
+        else
+                cgroup_runtime_forget_attributes(crt, crt->cgroup_realized_mask ^ target_mask);
+
         if (cg_unified_controller(SYSTEMD_CGROUP_CONTROLLER) > 0) {
                 uint64_t cgroup_id = 0;
 
@@ -3606,6 +3669,7 @@ void unit_prune_cgroup(Unit *u) {
         crt->cgroup_realized = false;
         crt->cgroup_realized_mask = 0;
         crt->cgroup_enabled_mask = 0;
+        crt->cgroup_attributes_written = hashmap_free(crt->cgroup_attributes_written);
 
         crt->bpf_device_control_installed = bpf_program_free(crt->bpf_device_control_installed);
 }
@@ -3767,13 +3831,24 @@ static int on_cgroup_empty_event(sd_event_source *s, void *userdata) {
 
         assert(s);
 
-        u = m->cgroup_empty_queue;
-        if (!u)
-                return 0;
+        /* When many cgroups run empty at once, handling only one unit per event loop iteration adds a lot
+         * of overhead. Process them in batches, but bounded, so that other event sources get their turn. */
+        for (unsigned n = 0; n < CGROUP_QUEUE_DISPATCH_MAX && (u = m->cgroup_empty_queue); n++) {
+                assert(u->in_cgroup_empty_queue);
+                u->in_cgroup_empty_queue = false;
+                LIST_REMOVE(cgroup_empty_queue, m->cgroup_empty_queue, u);
 
-        assert(u->in_cgroup_empty_queue);
-        u->in_cgroup_empty_queue = false;
-        LIST_REMOVE(cgroup_empty_queue, m->cgroup_empty_queue, u);
+                /* Update state based on OOM kills before we notify about cgroup empty event */
+                (void) unit_check_oom(u);
+                (void) unit_check_oomd_kill(u);
+
+                unit_add_to_gc_queue(u);
+
+                if (UNIT_IS_INACTIVE_OR_FAILED(unit_active_state(u)))
+                        unit_prune_cgroup(u);
+                else if (UNIT_VTABLE(u)->notify_cgroup_empty)
+                        UNIT_VTABLE(u)->notify_cgroup_empty(u);
+        }
 
         if (m->cgroup_empty_queue) {
                 /* More stuff queued, let's make sure we remain enabled */
@@ -3782,17 +3857,6 @@ static int on_cgroup_empty_event(sd_event_source *s, void *userdata) {
                         log_debug_errno(r, "Failed to reenable cgroup empty event source, ignoring: %m");
         }
 
-        /* Update state based on OOM kills before we notify about cgroup empty event */
-        (void) unit_check_oom(u);
-        (void) unit_check_oomd_kill(u);
-
-        unit_add_to_gc_queue(u);
-
-        if (UNIT_IS_INACTIVE_OR_FAILED(unit_active_state(u)))
-                unit_prune_cgroup(u);
-        else if (UNIT_VTABLE(u)->notify_cgroup_empty)
-                UNIT_VTABLE(u)->notify_cgroup_empty(u);
-
         return 0;
 }
 
@@ -3951,13 +4015,14 @@ static int on_cgroup_oom_event(sd_event_source *s, void *userdata) {
 
         assert(s);
 
-        u = m->cgroup_oom_queue;
-        if (!u)
-                return 0;
+        for (unsigned n = 0; n < CGROUP_QUEUE_DISPATCH_MAX && (u = m->cgroup_oom_queue); n++) {
+                assert(u->in_cgroup_oom_queue);
+                u->in_cgroup_oom_queue = false;
+                LIST_REMOVE(cgroup_oom_queue, m->cgroup_oom_queue, u);
 
-        assert(u->in_cgroup_oom_queue);
-        u->in_cgroup_oom_queue = false;
-        LIST_REMOVE(cgroup_oom_queue, m->cgroup_oom_queue, u);
+                (void) unit_check_oom(u);
+                unit_add_to_gc_queue(u);
+        }
 
         if (m->cgroup_oom_queue) {
                 /* More stuff queued, let's make sure we remain enabled */
@@ -3966,9 +4031,6 @@ static int on_cgroup_oom_event(sd_event_source *s, void *userdata) {
                         log_debug_errno(r, "Failed to reenable cgroup oom event source, ignoring: %m");
         }
 
-        (void) unit_check_oom(u);
-        unit_add_to_gc_queue(u);
-
         return 0;
 }
 
@@ -5244,6 +5306,7 @@ CGroupRuntime* cgroup_runtime_free(CGroupRuntime *crt) {
 
         bpf_firewall_close(crt);
 
+        hashmap_free(crt->cgroup_attributes_written);
         free(crt->cgroup_path);
 
         return mfree(crt);
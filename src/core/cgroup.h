@@ -322,6 +322,10 @@ typedef struct CGroupRuntime {
         CGroupMask cgroup_invalidated_mask;        /* A mask specifying controllers which shall be considered invalidated, and require re-realization */
         CGroupMask cgroup_members_mask;            /* A cache for the controllers required by all children of this cgroup (only relevant for slice units) */
 
+        /* The values we most recently wrote to the cgroup's attributes, attribute name → value. Used to
+         * suppress redundant writes when the cgroup is realized again. */
+        Hashmap *cgroup_attributes_written;
+
         /* Inotify watch descriptors for watching cgroup.events and memory.events on cgroupv2 */
         int cgroup_control_inotify_wd;
         int cgroup_memory_inotify_wd;
@@ -226,7 +226,7 @@ static int manager_deserialize_units(Manager *m, FILE *f, FDSet *fds) {
                 _cleanup_free_ char *line = NULL;
 
                 /* Start marker */
-                r = read_stripped_line(f, LONG_LINE_MAX, &line);
+                r = read_stripped_line_full(f, LONG_LINE_MAX, READ_LINE_NOT_A_TTY, &line);
                 if (r < 0)
                         return log_error_errno(r, "Failed to read serialization line: %m");
                 if (r == 0)
@@ -748,6 +748,7 @@ static void manager_free_unit_name_maps(Manager *m) {
         m->unit_name_map = hashmap_free(m->unit_name_map);
         m->unit_path_cache = set_free(m->unit_path_cache);
         m->unit_cache_timestamp_hash = 0;
+        m->unit_cache_checked = false;
 }
 
 static int manager_setup_run_queue(Manager *m) {
@@ -1046,12 +1047,12 @@ int manager_new(RuntimeScope runtime_scope, ManagerTestRunFlags test_run_flags,
                 if (m->executor_fd < 0)
                         return log_debug_errno(m->executor_fd, "Failed to pin executor binary: %m");
 
-                if (DEBUG_LOGGING) {
-                        _cleanup_free_ char *executor_path = NULL;
+                /* Resolve the path once here, rather than for every process we spawn */
+                r = fd_get_path(m->executor_fd, &m->executor_path);
+                if (r < 0)
+                        log_debug_errno(r, "Failed to get path of executor binary, ignoring: %m");
 
-                        (void) fd_get_path(m->executor_fd, &executor_path);
-                        log_debug("Using systemd-executor binary from '%s'.", strna(executor_path));
-                }
+                log_debug("Using systemd-executor binary from '%s'.", strna(m->executor_path));
         }
 
         /* Note that we do not set up the notify fd here. We do that after deserialization,
@@ -1767,6 +1768,7 @@ Manager* manager_free(Manager *m) {
 #endif
 
         safe_close(m->executor_fd);
+        free(m->executor_path);
 
         return mfree(m);
 }
@@ -2311,6 +2313,7 @@ unsigned manager_dispatch_load_queue(Manager *m) {
         }
 
         m->dispatching_load_queue = false;
+        m->unit_cache_checked = false;
 
         /* Dispatch the units waiting for their target dependencies to be added now, as all targets that we know about
          * should be loaded and have aliases resolved */
@@ -301,9 +301,12 @@ static void transaction_drop_redundant(Transaction *tr) {
                         if (!keep) {
                                 log_trace("Found redundant job %s/%s, dropping from transaction.",
                                           j->unit->id, job_type_to_string(j->type));
+
+                                /* This only removes (or replaces) the current entry of the hashmap, hence
+                                 * we can continue iterating rather than starting over after every deleted
+                                 * job. Other jobs for the same unit are taken care of in the next pass. */
                                 transaction_delete_job(tr, j, false);
                                 again = true;
-                                break;
                         }
                 }
         } while (again);
@@ -520,9 +523,14 @@ static void transaction_collect_garbage(Transaction *tr) {
 
                         if (!j->object_list) {
                                 log_trace("Garbage collecting job %s/%s", j->unit->id, job_type_to_string(j->type));
+
+                                /* The job has no object list, hence deleting it won't recurse into other
+                                 * jobs, and only the current hashmap entry is removed (or replaced). Thus we
+                                 * can just continue iterating, and only need another pass for the jobs
+                                 * that became garbage because of this one. */
                                 transaction_delete_job(tr, j, true);
                                 again = true;
-                                break;
+                                continue;
                         }
 
                         log_trace("Keeping job %s/%s because of %s/%s",
@@ -388,7 +388,7 @@ int unit_deserialize_state_skip(FILE *f) {
         for (;;) {
                 _cleanup_free_ char *line = NULL;
 
-                r = read_stripped_line(f, LONG_LINE_MAX, &line);
+                r = read_stripped_line_full(f, LONG_LINE_MAX, READ_LINE_NOT_A_TTY, &line);
                 if (r < 0)
                         return log_error_errno(r, "Failed to read serialization line: %m");
                 if (r == 0)
@@ -90,6 +90,12 @@ static int open_output(RemoteServer *s, Writer *w, const char* host) {
         if (r < 0)
                 return log_error_errno(r, "Failed to open output journal %s: %m", filename);
 
+        /* Coalesce the notifications of readers about new entries, instead of truncating the file once for
+         * every entry we receive. Rotated files inherit the timer. */
+        r = journal_file_enable_post_change_timer(w->journal, s->event, POST_CHANGE_TIMER_INTERVAL_USEC);
+        if (r < 0)
+                return log_error_errno(r, "Failed to enable post change timer for %s: %m", w->journal->path);
+
         log_debug("Opened output file %s", w->journal->path);
         return 0;
 }
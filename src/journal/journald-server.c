@@ -79,9 +79,6 @@
 
 #define NOTIFY_SNDBUF_SIZE (8*1024*1024)
 
-/* The period to insert between posting changes for coalescing */
-#define POST_CHANGE_TIMER_INTERVAL_USEC (250*USEC_PER_MSEC)
-
 /* Pick a good default that is likely to fit into AF_UNIX and AF_INET SOCK_DGRAM datagrams, and even leaves some room
  * for a bit of additional metadata. */
 #define DEFAULT_LINE_MAX (48*1024)
@@ -90,6 +87,10 @@
 
 #define IDLE_TIMEOUT_USEC (30*USEC_PER_SEC)
 
+/* How many datagrams to read off a socket per event loop iteration at most, before giving the other event
+ * sources a chance again. */
+#define DATAGRAMS_PER_DISPATCH_MAX 16u
+
 #define FAILED_TO_WRITE_ENTRY_RATELIMIT ((const RateLimit) { .interval = 1 * USEC_PER_SEC, .burst = 1 })
 
 static int server_schedule_sync(Server *s, int priority);
@@ -1487,14 +1488,8 @@ static int server_relinquish_var(Server *s) {
         return 0;
 }
 
-int server_process_datagram(
-                sd_event_source *es,
-                int fd,
-                uint32_t revents,
-                void *userdata) {
-
+static int server_process_datagram_one(Server *s, int fd) {
         size_t label_len = 0, m;
-        Server *s = ASSERT_PTR(userdata);
         struct ucred *ucred = NULL;
         struct timeval tv_buf, *tv = NULL;
         struct cmsghdr *cmsg;
@@ -1527,12 +1522,10 @@ int server_process_datagram(
                 .msg_namelen = sizeof(sa),
         };
 
+        assert(s);
         assert(fd == s->native_fd || fd == s->syslog_fd || fd == s->audit_fd);
 
-        if (revents != EPOLLIN)
-                return log_error_errno(SYNTHETIC_ERRNO(EIO),
-                                       "Got invalid event from epoll for datagram fd: %" PRIx32,
-                                       revents);
+        /* Returns > 0 if a datagram was consumed, 0 if there was nothing to read. */
 
         /* Try to get the right size, if we can. (Not all sockets support SIOCINQ, hence we just try, but don't rely on
          * it.) */
@@ -1554,11 +1547,11 @@ int server_process_datagram(
         if (n == -ECHRNG) {
                 log_ratelimit_warning_errno(n, JOURNAL_LOG_RATELIMIT,
                                             "Got message with truncated control data (too many fds sent?), ignoring.");
-                return 0;
+                return 1;
         }
         if (n == -EXFULL) {
                 log_ratelimit_warning_errno(n, JOURNAL_LOG_RATELIMIT, "Got message with truncated payload data, ignoring.");
-                return 0;
+                return 1;
         }
         if (n < 0)
                 return log_ratelimit_error_errno(n, JOURNAL_LOG_RATELIMIT, "Failed to receive message: %m");
@@ -1616,6 +1609,33 @@ int server_process_datagram(
         }
 
         close_many(fds, n_fds);
+        return 1;
+}
+
+int server_process_datagram(
+                sd_event_source *es,
+                int fd,
+                uint32_t revents,
+                void *userdata) {
+
+        Server *s = ASSERT_PTR(userdata);
+        int r;
+
+        if (revents != EPOLLIN)
+                return log_error_errno(SYNTHETIC_ERRNO(EIO),
+                                       "Got invalid event from epoll for datagram fd: %" PRIx32,
+                                       revents);
+
+        /* Read a bunch of datagrams in one go, so that a burst of messages doesn't cost us a full event
+         * loop iteration (and thus an epoll_wait()) per message. The number is bounded however, so that a
+         * single busy socket cannot starve the other sources of the same priority. */
+        for (unsigned i = 0; i < DATAGRAMS_PER_DISPATCH_MAX; i++) {
+                r = server_process_datagram_one(s, fd);
+                if (r < 0)
+                        return r;
+                if (r == 0)
+                        break;
+        }
 
         server_refresh_idle_timer(s);
         return 0;
@@ -2528,6 +2548,9 @@ static int server_memory_pressure(sd_event_source *es, void *userdata) {
                 (void) journal_file_offline_close(first);
         }
 
+        /* Drop the memory maps of the remaining files we don't need right now */
+        mmap_cache_trim(s->mmap);
+
         sd_event_trim_memory();
 
         return 0;
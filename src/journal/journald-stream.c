@@ -81,6 +81,7 @@ struct StdoutStream {
         struct ucred ucred;
         char *label;
         char *identifier;
+        char *identifier_field;
         char *unit_id;
         int priority;
         bool level_prefix:1;
@@ -94,6 +95,8 @@ struct StdoutStream {
         char *buffer;
         size_t length;
 
+        char *message;
+
         sd_event_source *event_source;
 
         char *state_file;
@@ -128,9 +131,11 @@ StdoutStream* stdout_stream_free(StdoutStream *s) {
         safe_close(s->fd);
         free(s->label);
         free(s->identifier);
+        free(s->identifier_field);
         free(s->unit_id);
         free(s->state_file);
         free(s->buffer);
+        free(s->message);
 
         return mfree(s);
 }
@@ -255,7 +260,6 @@ static int stdout_stream_log(
         int priority;
         char syslog_priority[] = "PRIORITY=\0";
         char syslog_facility[STRLEN("SYSLOG_FACILITY=") + DECIMAL_STR_MAX(int) + 1];
-        _cleanup_free_ char *message = NULL, *syslog_identifier = NULL;
         size_t n = 0, m;
         int r;
 
@@ -316,9 +320,12 @@ static int stdout_stream_log(
         }
 
         if (s->identifier) {
-                syslog_identifier = strjoin("SYSLOG_IDENTIFIER=", s->identifier);
-                if (syslog_identifier)
-                        iovec[n++] = IOVEC_MAKE_STRING(syslog_identifier);
+                /* The identifier doesn't change anymore once the stream is set up, hence format the field
+                 * only once. */
+                if (!s->identifier_field)
+                        s->identifier_field = strjoin("SYSLOG_IDENTIFIER=", s->identifier);
+                if (s->identifier_field)
+                        iovec[n++] = IOVEC_MAKE_STRING(s->identifier_field);
         }
 
         static const char * const line_break_field_table[_LINE_BREAK_MAX] = {
@@ -336,9 +343,12 @@ static int stdout_stream_log(
         if (c)
                 iovec[n++] = IOVEC_MAKE_STRING(c);
 
-        message = strjoin("MESSAGE=", p);
-        if (message)
-                iovec[n++] = IOVEC_MAKE_STRING(message);
+        /* Assemble the MESSAGE= field in a buffer we keep around, to avoid an allocation for every line */
+        size_t l = strlen(p);
+        if (GREEDY_REALLOC(s->message, STRLEN("MESSAGE=") + l)) {
+                memcpy(mempcpy(s->message, "MESSAGE=", STRLEN("MESSAGE=")), p, l);
+                iovec[n++] = IOVEC_MAKE(s->message, STRLEN("MESSAGE=") + l);
+        }
 
         server_dispatch_message(s->server, iovec, n, m, s->context, NULL, priority, 0);
         return 0;
@@ -565,6 +575,7 @@ static int stdout_stream_process(sd_event_source *es, int fd, uint32_t revents,
         CMSG_BUFFER_TYPE(CMSG_SPACE(sizeof(struct ucred))) control;
         size_t limit, consumed, allocated;
         StdoutStream *s = ASSERT_PTR(userdata);
+        bool filled;
         struct ucred *ucred;
         struct iovec iovec;
         ssize_t l;
@@ -610,6 +621,8 @@ static int stdout_stream_process(sd_event_source *es, int fd, uint32_t revents,
         }
         cmsg_close_all(&msghdr);
 
+        filled = (size_t) l == iovec.iov_len;
+
         if (l == 0) {
                 (void) stdout_stream_scan(s, s->buffer, s->length, /* force_flush = */ LINE_BREAK_EOF, NULL);
                 goto terminate;
@@ -647,6 +660,11 @@ static int stdout_stream_process(sd_event_source *es, int fd, uint32_t revents,
         s->length = l - consumed;
         memmove(s->buffer, p + consumed, s->length);
 
+        /* If we filled up the buffer completely there's likely more queued. In that case double the buffer
+         * (up to the line size limit), so that busy streams are processed with fewer, larger reads. */
+        if (filled && allocated - 1 < MAX(s->server->line_max, STDOUT_STREAM_SETUP_PROTOCOL_LINE_MAX))
+                (void) GREEDY_REALLOC(s->buffer, allocated + 1);
+
         return 1;
 
 terminate:
@@ -0,0 +1,74 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+
+#include <linux/sockios.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include "alloc-util.h"
+#include "fd-util.h"
+#include "fuzz-journald.h"
+#include "io-util.h"
+#include "journald-stream.h"
+#include "parse-util.h"
+#include "tests.h"
+#include "time-util.h"
+
+#define LINE "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore.\n"
+#define LINES_PER_CHUNK 512U
+
+int main(int argc, char *argv[]) {
+        _cleanup_close_pair_ int stream_fds[2] = EBADF_PAIR;
+        _cleanup_(server_freep) Server *s = NULL;
+        _cleanup_free_ char *chunk = NULL;
+        unsigned n_chunks = 2000;
+        StdoutStream *stream;
+        usec_t start, elapsed;
+        uint64_t n_lines;
+        int v, fd0;
+
+        test_setup_logging(LOG_INFO);
+
+        if (argc > 1)
+                assert_se(safe_atou(argv[1], &n_chunks) >= 0);
+
+        /* Only the writing side blocks, the stream is read non-blocking from the event loop as in journald */
+        assert_se(socketpair(AF_UNIX, SOCK_STREAM|SOCK_CLOEXEC, 0, stream_fds) >= 0);
+        assert_se(fd_nonblock(stream_fds[0], true) >= 0);
+
+        assert_se(server_new(&s) >= 0);
+        dummy_server_init(s, NULL, 0);
+        s->forward_to_wall = false;
+
+        assert_se(stdout_stream_install(s, stream_fds[0], &stream) >= 0);
+        fd0 = TAKE_FD(stream_fds[0]); /* avoid double close */
+
+        /* Identifier, unit ID, priority, level prefix, forward to syslog, kmsg, console */
+        assert_se(loop_write(stream_fds[1], "test-journald-stream-benchmark\n\n6\n0\n0\n0\n0\n", SIZE_MAX) >= 0);
+
+        chunk = new(char, STRLEN(LINE) * LINES_PER_CHUNK);
+        assert_se(chunk);
+        for (unsigned i = 0; i < LINES_PER_CHUNK; i++)
+                memcpy(chunk + i * STRLEN(LINE), LINE, STRLEN(LINE));
+
+        start = now(CLOCK_MONOTONIC);
+
+        for (unsigned i = 0; i < n_chunks; i++) {
+                assert_se(loop_write(stream_fds[1], chunk, STRLEN(LINE) * LINES_PER_CHUNK) >= 0);
+
+                while (ioctl(fd0, SIOCINQ, &v) == 0 && v > 0)
+                        assert_se(sd_event_run(s->event, UINT64_MAX) >= 0);
+        }
+
+        elapsed = usec_sub_unsigned(now(CLOCK_MONOTONIC), start);
+        n_lines = (uint64_t) n_chunks * LINES_PER_CHUNK;
+
+        log_info("Processed %" PRIu64 " lines in %s, %" PRIu64 " lines/s.",
+                 n_lines,
+                 FORMAT_TIMESPAN(elapsed, USEC_PER_MSEC),
+                 elapsed > 0 ? n_lines * USEC_PER_SEC / elapsed : 0);
+
+        if (s->n_stdout_streams > 0)
+                stdout_stream_destroy(stream);
+
+        return 0;
+}
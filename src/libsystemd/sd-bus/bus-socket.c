@@ -1183,9 +1183,8 @@ int bus_socket_take_fd(sd_bus *b) {
 
 int bus_socket_write_message(sd_bus *bus, sd_bus_message *m, size_t *idx) {
         struct iovec *iov;
+        unsigned j = 0;
         ssize_t k;
-        size_t n;
-        unsigned j;
         int r;
 
         assert(bus);
@@ -1200,19 +1199,24 @@ int bus_socket_write_message(sd_bus *bus, sd_bus_message *m, size_t *idx) {
         if (r < 0)
                 return r;
 
-        n = m->n_iovec * sizeof(struct iovec);
-        iov = newa(struct iovec, n);
-        memcpy_safe(iov, m->iovec, n);
-
-        j = 0;
-        iovec_advance(iov, &j, *idx);
+        if (*idx == 0)
+                /* Nothing written yet, which is the common case: pass the message's iovecs on as they are,
+                 * they are not modified by the kernel. */
+                iov = m->iovec;
+        else {
+                /* Partially written already: skip over the part that's already out, and only pass the
+                 * remaining iovecs on. */
+                iov = newa(struct iovec, m->n_iovec);
+                memcpy_safe(iov, m->iovec, m->n_iovec * sizeof(struct iovec));
+                iovec_advance(iov, &j, *idx);
+        }
 
         if (bus->prefer_writev)
-                k = writev(bus->output_fd, iov, m->n_iovec);
+                k = writev(bus->output_fd, iov + j, m->n_iovec - j);
         else {
                 struct msghdr mh = {
-                        .msg_iov = iov,
-                        .msg_iovlen = m->n_iovec,
+                        .msg_iov = iov + j,
+                        .msg_iovlen = m->n_iovec - j,
                 };
 
                 if (m->n_fds > 0 && *idx == 0) {
@@ -1230,7 +1234,7 @@ int bus_socket_write_message(sd_bus *bus, sd_bus_message *m, size_t *idx) {
                 k = sendmsg(bus->output_fd, &mh, MSG_DONTWAIT|MSG_NOSIGNAL);
                 if (k < 0 && errno == ENOTSOCK) {
                         bus->prefer_writev = true;
-                        k = writev(bus->output_fd, iov, m->n_iovec);
+                        k = writev(bus->output_fd, iov + j, m->n_iovec - j);
                 }
         }
 
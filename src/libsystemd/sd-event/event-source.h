@@ -78,6 +78,11 @@ struct sd_event_source {
 
         RateLimit rate_limit;
 
+        /* Handler runtime statistics, only collected if $SD_EVENT_PROFILE_DELAYS is set */
+        unsigned n_dispatched;
+        usec_t dispatch_usec;
+        usec_t dispatch_max_usec;
+
         /* These are primarily fields relevant for time event sources, but since any event source can
          * effectively become one when rate-limited, this is part of the common fields. */
         unsigned earliest_index;
@@ -160,6 +165,7 @@ struct clock_data {
         usec_t next;
 
         bool needs_rearm:1;
+        bool elapsed:1; /* timerfd fired and wasn't reprogrammed since, i.e. is still readable */
 };
 
 struct signal_data {
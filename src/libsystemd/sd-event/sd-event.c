@@ -432,7 +432,8 @@ _public_ int sd_event_new(sd_event** ret) {
         e->epoll_fd = fd_move_above_stdio(e->epoll_fd);
 
         if (secure_getenv("SD_EVENT_PROFILE_DELAYS")) {
-                log_debug("Event loop profiling enabled. Logarithmic histogram of event loop iterations in the range 2^0 %s 2^63 us will be logged every 5s.",
+                log_debug("Event loop profiling enabled. Logarithmic histogram of event loop iterations in the range 2^0 %s 2^63 us "
+                          "and per event source handler runtimes will be logged every 5s.",
                           special_glyph(SPECIAL_GLYPH_ELLIPSIS));
                 e->profile_delays = true;
         }
@@ -3126,6 +3127,12 @@ _public_ int sd_event_source_set_time(sd_event_source *s, uint64_t usec) {
         assert_return(s->event->state != SD_EVENT_FINISHED, -ESTALE);
         assert_return(!event_origin_changed(s->event), -ECHILD);
 
+        /* Timers are frequently rearmed to the time they already have (e.g. via event_reset_time()). If the
+         * source isn't pending either, its position in the prioqs doesn't change, hence skip the reshuffle
+         * and the recalculation of the wakeup time. */
+        if (s->time.next == usec && !s->pending)
+                return 0;
+
         r = source_set_pending(s, false);
         if (r < 0)
                 return r;
@@ -3177,13 +3184,16 @@ _public_ int sd_event_source_set_time_accuracy(sd_event_source *s, uint64_t usec
         assert_return(s->event->state != SD_EVENT_FINISHED, -ESTALE);
         assert_return(!event_origin_changed(s->event), -ECHILD);
 
+        if (usec == 0)
+                usec = DEFAULT_ACCURACY_USEC;
+
+        if (s->time.accuracy == usec && !s->pending)
+                return 0;
+
         r = source_set_pending(s, false);
         if (r < 0)
                 return r;
 
-        if (usec == 0)
-                usec = DEFAULT_ACCURACY_USEC;
-
         s->time.accuracy = usec;
 
         event_source_time_prioq_reshuffle(s);
@@ -3600,7 +3610,7 @@ static int event_arm_timer(
                 if (d->fd < 0)
                         return 0;
 
-                if (d->next == USEC_INFINITY)
+                if (d->next == USEC_INFINITY && !d->elapsed)
                         return 0;
 
                 /* disarm */
@@ -3608,6 +3618,7 @@ static int event_arm_timer(
                         return -errno;
 
                 d->next = USEC_INFINITY;
+                d->elapsed = false;
                 return 0;
         }
 
@@ -3616,7 +3627,7 @@ static int event_arm_timer(
         assert(b && b->enabled != SD_EVENT_OFF);
 
         t = sleep_between(e, time_event_source_next(a), time_event_source_latest(b));
-        if (d->next == t)
+        if (d->next == t && !d->elapsed)
                 return 0;
 
         assert_se(d->fd >= 0);
@@ -3632,6 +3643,7 @@ static int event_arm_timer(
                 return -errno;
 
         d->next = t;
+        d->elapsed = false;
         return 0;
 }
 
@@ -3654,7 +3666,7 @@ static int process_io(sd_event *e, sd_event_source *s, uint32_t revents) {
         return source_set_pending(s, true);
 }
 
-static int flush_timer(sd_event *e, int fd, uint32_t events, usec_t *next) {
+static int flush_timer(sd_event *e, int fd, uint32_t events) {
         uint64_t x;
         ssize_t ss;
 
@@ -3674,8 +3686,22 @@ static int flush_timer(sd_event *e, int fd, uint32_t events, usec_t *next) {
         if (_unlikely_(ss != sizeof(x)))
                 return -EIO;
 
-        if (next)
-                *next = USEC_INFINITY;
+        return 0;
+}
+
+static int process_clock(sd_event *e, struct clock_data *d, uint32_t events) {
+        assert(e);
+        assert(d);
+
+        assert_return(events == EPOLLIN, -EIO);
+
+        /* Unlike flush_timer() we don't read the expiration counter off the timerfd here: before we go to
+         * sleep again event_arm_timer() will reprogram or disarm the timer, and timerfd_settime() resets
+         * the counter, which makes the fd non-readable again. Saves one read() per timer wakeup. */
+
+        d->next = USEC_INFINITY;
+        d->elapsed = true;
+        d->needs_rearm = true;
 
         return 0;
 }
@@ -4156,9 +4182,18 @@ static int source_memory_pressure_initiate_dispatch(sd_event_source *s) {
         return 0; /* go on, dispatch to user callback */
 }
 
+static void source_account_dispatch(sd_event_source *s, usec_t t) {
+        assert(s);
+
+        s->n_dispatched++;
+        s->dispatch_usec = usec_add(s->dispatch_usec, t);
+        s->dispatch_max_usec = MAX(s->dispatch_max_usec, t);
+}
+
 static int source_dispatch(sd_event_source *s) {
         EventSourceType saved_type;
         sd_event *saved_event;
+        usec_t dispatch_start = 0;
         int r = 0;
 
         assert(s);
@@ -4220,6 +4255,9 @@ static int source_dispatch(sd_event_source *s) {
                         return r;
         }
 
+        if (saved_event->profile_delays)
+                dispatch_start = now(CLOCK_MONOTONIC);
+
         s->dispatching = true;
 
         switch (s->type) {
@@ -4312,6 +4350,9 @@ static int source_dispatch(sd_event_source *s) {
 
         s->dispatching = false;
 
+        if (dispatch_start > 0)
+                source_account_dispatch(s, usec_sub_unsigned(now(CLOCK_MONOTONIC), dispatch_start));
+
 finish:
         if (r < 0) {
                 log_debug_errno(r, "Event source %s (type %s) returned error, %s: %m",
@@ -4658,7 +4699,7 @@ static int process_epoll(sd_event *e, usec_t timeout, int64_t threshold, int64_t
         for (size_t i = 0; i < m; i++) {
 
                 if (e->event_queue[i].data.ptr == INT_TO_PTR(SOURCE_WATCHDOG))
-                        r = flush_timer(e, e->watchdog_fd, e->event_queue[i].events, NULL);
+                        r = flush_timer(e, e->watchdog_fd, e->event_queue[i].events);
                 else {
                         WakeupType *t = e->event_queue[i].data.ptr;
 
@@ -4695,14 +4736,9 @@ static int process_epoll(sd_event *e, usec_t timeout, int64_t threshold, int64_t
                                 break;
                         }
 
-                        case WAKEUP_CLOCK_DATA: {
-                                struct clock_data *d = e->event_queue[i].data.ptr;
-
-                                assert(d);
-
-                                r = flush_timer(e, d->fd, e->event_queue[i].events, &d->next);
+                        case WAKEUP_CLOCK_DATA:
+                                r = process_clock(e, e->event_queue[i].data.ptr, e->event_queue[i].events);
                                 break;
-                        }
 
                         case WAKEUP_SIGNAL_DATA:
                                 r = process_signal(e, e->event_queue[i].data.ptr, e->event_queue[i].events, &min_priority);
@@ -4867,6 +4903,21 @@ static void event_log_delays(sd_event *e) {
                 e->delays[i] = 0;
         }
         log_debug("Event loop iterations: %s", b);
+
+        LIST_FOREACH(sources, s, e->sources) {
+                if (s->n_dispatched == 0)
+                        continue;
+
+                log_debug("Event source %s (type %s): dispatched %u times, handler took %s in total, %s max.",
+                          strna(s->description),
+                          event_source_type_to_string(s->type),
+                          s->n_dispatched,
+                          FORMAT_TIMESPAN(s->dispatch_usec, 1),
+                          FORMAT_TIMESPAN(s->dispatch_max_usec, 1));
+
+                s->n_dispatched = 0;
+                s->dispatch_usec = s->dispatch_max_usec = 0;
+        }
 }
 
 _public_ int sd_event_run(sd_event *e, uint64_t timeout) {
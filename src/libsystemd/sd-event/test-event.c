@@ -741,6 +741,58 @@ TEST(simple_timeout) {
         assert_se(t >= usec_add(f, some_time));
 }
 
+#define N_MANY_TIMERS 10000U
+
+static int many_timers_handler(sd_event_source *s, uint64_t usec, void *userdata) {
+        unsigned *n_fired = ASSERT_PTR(userdata);
+
+        /* Timers must never be dispatched before they elapse */
+        assert_se(usec <= now(CLOCK_MONOTONIC));
+
+        if (++*n_fired == N_MANY_TIMERS)
+                assert_se(sd_event_exit(sd_event_source_get_event(s), 0) >= 0);
+
+        return 0;
+}
+
+TEST(many_timers) {
+        _cleanup_(sd_event_unrefp) sd_event *e = NULL;
+        _cleanup_free_ sd_event_source **sources = NULL;
+        unsigned n_fired = 0;
+        usec_t base;
+
+        assert_se(sd_event_new(&e) >= 0);
+
+        sources = new0(sd_event_source*, N_MANY_TIMERS);
+        assert_se(sources);
+
+        base = now(CLOCK_MONOTONIC);
+
+        for (unsigned i = 0; i < N_MANY_TIMERS; i++)
+                assert_se(sd_event_add_time(e, sources + i, CLOCK_MONOTONIC,
+                                            base + random_u64_range(100 * USEC_PER_MSEC), 1,
+                                            many_timers_handler, &n_fired) >= 0);
+
+        /* Reschedule every other timer, and rearm the rest with their current values, which should be a NOP */
+        for (unsigned i = 0; i < N_MANY_TIMERS; i++) {
+                usec_t t;
+
+                if (i % 2 == 0)
+                        assert_se(sd_event_source_set_time(sources[i], base + random_u64_range(100 * USEC_PER_MSEC)) >= 0);
+                else {
+                        assert_se(sd_event_source_get_time(sources[i], &t) >= 0);
+                        assert_se(sd_event_source_set_time(sources[i], t) >= 0);
+                        assert_se(sd_event_source_set_time_accuracy(sources[i], 1) >= 0);
+                }
+        }
+
+        assert_se(sd_event_loop(e) >= 0);
+        assert_se(n_fired == N_MANY_TIMERS);
+
+        for (unsigned i = 0; i < N_MANY_TIMERS; i++)
+                sd_event_source_unref(sources[i]);
+}
+
 static int inotify_self_destroy_handler(sd_event_source *s, const struct inotify_event *ev, void *userdata) {
         sd_event_source **p = userdata;
 
@@ -313,6 +313,9 @@ int journal_file_parse_uid_from_filename(const char *path, uid_t *uid);
 
 int journal_file_dispose(int dir_fd, const char *fname);
 
+/* The period to insert between posting changes for coalescing */
+#define POST_CHANGE_TIMER_INTERVAL_USEC (250*USEC_PER_MSEC)
+
 void journal_file_post_change(JournalFile *f);
 int journal_file_enable_post_change_timer(JournalFile *f, sd_event *e, usec_t t);
 
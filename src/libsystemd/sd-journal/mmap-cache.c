@@ -49,6 +49,12 @@ struct MMapFileDescriptor {
         int prot;
         bool sigbus;
 
+        /* The range of the window most recently mapped for this file, and how many windows in a row
+         * were mapped right after their predecessor, i.e. how long the file has been read front to back. */
+        uint64_t last_offset;
+        uint64_t last_end;
+        unsigned n_sequential;
+
         LIST_HEAD(Window, windows);
 };
 
@@ -59,6 +65,8 @@ struct MMapCache {
         unsigned n_category_cache_hit;
         unsigned n_window_list_hit;
         unsigned n_missed;
+        unsigned n_missed_sequential;
+        unsigned n_unmapped;
 
         Hashmap *fds;
 
@@ -77,6 +85,16 @@ struct MMapCache {
 # define WINDOW_SIZE ((size_t) (UINT64_C(8) * UINT64_C(1024) * UINT64_C(1024)))
 #endif
 
+/* When a file is read sequentially, windows are doubled in size with each sequential miss, up to this
+ * many times. As up to WINDOWS_MIN unused windows are kept around, that's up to 2 GiB of mappings with
+ * 32 MiB windows, which is too much for a 32-bit address space. Hence, don't grow windows there, they
+ * are still mapped ahead though. */
+#if SIZE_MAX > UINT32_MAX
+# define WINDOW_SEQUENTIAL_SHIFT_MAX 2u
+#else
+# define WINDOW_SEQUENTIAL_SHIFT_MAX 0u
+#endif
+
 MMapCache* mmap_cache_new(void) {
         MMapCache *m;
 
@@ -96,8 +114,10 @@ static Window* window_unlink(Window *w) {
 
         MMapCache *m = mmap_cache_fd_cache(w->fd);
 
-        if (w->ptr)
+        if (w->ptr) {
                 munmap(w->ptr, w->size);
+                m->n_unmapped++;
+        }
 
         if (FLAGS_SET(w->flags, WINDOW_IN_UNUSED)) {
                 if (m->last_unused == w)
@@ -279,6 +299,8 @@ static int add_mmap(
                 struct stat *st,
                 Window **ret) {
 
+        MMapCache *m = mmap_cache_fd_cache(f);
+        bool sequential;
         Window *w;
         void *d;
         int r;
@@ -294,7 +316,27 @@ static int add_mmap(
         size = PAGE_ALIGN(size + PAGE_OFFSET_U64(offset));
         offset = PAGE_ALIGN_DOWN_U64(offset);
 
-        if (size < WINDOW_SIZE) {
+        /* If the requested range begins within or shortly after the window we mapped last for this file,
+         * the file is most likely streamed front to back (e.g. by journalctl without filters, or by
+         * journal-upload). In that case there's no point in centering the window around the requested
+         * offset, as we won't look behind it anyway. Instead, map ahead, grow the window with every
+         * further sequential miss, and tell the kernel to read ahead aggressively. Random accesses, such
+         * as the bisection of entry arrays, reset this and get the regular centered windows. */
+        sequential = f->last_end > 0 &&
+                offset > f->last_offset &&
+                offset <= f->last_end + WINDOW_SIZE;
+        if (sequential)
+                f->n_sequential = MIN(f->n_sequential + 1, WINDOW_SEQUENTIAL_SHIFT_MAX);
+        else
+                f->n_sequential = 0;
+
+        if (sequential) {
+                size_t window_size = WINDOW_SIZE << f->n_sequential;
+
+                if (size < window_size)
+                        size = window_size;
+
+        } else if (size < WINDOW_SIZE) {
                 uint64_t delta;
 
                 delta = PAGE_ALIGN((WINDOW_SIZE - size) / 2);
@@ -320,12 +362,20 @@ static int add_mmap(
         if (r < 0)
                 return r;
 
+        if (sequential) {
+                (void) madvise(d, size, MADV_SEQUENTIAL);
+                m->n_missed_sequential++;
+        }
+
         w = window_add(f, offset, size, d);
         if (!w) {
                 (void) munmap(d, size);
                 return -ENOMEM;
         }
 
+        f->last_offset = offset;
+        f->last_end = offset + size;
+
         *ret = w;
         return 0;
 }
@@ -427,11 +477,41 @@ found:
         return 1;
 }
 
+void mmap_cache_trim(MMapCache *m) {
+        unsigned n = 0;
+
+        assert(m);
+
+        /* Unmaps all windows that are currently not referenced by any category. They are otherwise kept
+         * around until the number of windows exceeds WINDOWS_MIN, and pin file pages in memory which the
+         * kernel then cannot reclaim as easily. They'll be mapped again on demand. */
+
+        while (m->last_unused) {
+                window_free(m->last_unused);
+                n++;
+        }
+
+        log_debug("Unmapped %u unused mmap cache windows.", n);
+}
+
+void mmap_cache_get_stats(MMapCache *m, MMapCacheStats *ret) {
+        assert(m);
+        assert(ret);
+
+        *ret = (MMapCacheStats) {
+                .n_category_cache_hit = m->n_category_cache_hit,
+                .n_window_list_hit = m->n_window_list_hit,
+                .n_missed = m->n_missed,
+                .n_missed_sequential = m->n_missed_sequential,
+                .n_unmapped = m->n_unmapped,
+        };
+}
+
 void mmap_cache_stats_log_debug(MMapCache *m) {
         assert(m);
 
-        log_debug("mmap cache statistics: %u category cache hit, %u window list hit, %u miss",
-                  m->n_category_cache_hit, m->n_window_list_hit, m->n_missed);
+        log_debug("mmap cache statistics: %u category cache hit, %u window list hit, %u miss (%u sequential), %u unmapped",
+                  m->n_category_cache_hit, m->n_window_list_hit, m->n_missed, m->n_missed_sequential, m->n_unmapped);
 }
 
 static void mmap_cache_process_sigbus(MMapCache *m) {
@@ -55,6 +55,17 @@ int mmap_cache_add_fd(MMapCache *m, int fd, int prot, MMapFileDescriptor **ret);
 MMapCache* mmap_cache_fd_cache(MMapFileDescriptor *f);
 MMapFileDescriptor* mmap_cache_fd_free(MMapFileDescriptor *f);
 
+void mmap_cache_trim(MMapCache *m);
+
+typedef struct MMapCacheStats {
+        unsigned n_category_cache_hit;
+        unsigned n_window_list_hit;
+        unsigned n_missed;
+        unsigned n_missed_sequential;
+        unsigned n_unmapped;
+} MMapCacheStats;
+
+void mmap_cache_get_stats(MMapCache *m, MMapCacheStats *ret);
 void mmap_cache_stats_log_debug(MMapCache *m);
 
 bool mmap_cache_fd_got_sigbus(MMapFileDescriptor *f);
@@ -812,6 +812,53 @@ static int move_by_boot_for_data(
         }
 }
 
+static int match_may_be_fulfilled(sd_journal *j, Match *m, JournalFile *f) {
+        int r;
+
+        assert(j);
+        assert(m);
+        assert(f);
+
+        /* Checks whether the file contains the data objects required by the match at all. This only probes
+         * the data hash table and does not touch any entry array, hence it is cheap compared with the
+         * bisections done by find_location_for_match(). It allows us to skip files early that cannot match
+         * a conjunction, before we bisect the entry arrays of the terms that do exist in the file. */
+
+        if (m->type == MATCH_DISCRETE) {
+                uint64_t hash;
+
+                if (JOURNAL_HEADER_KEYED_HASH(f->header))
+                        hash = journal_file_hash_data(f, m->data, m->size);
+                else
+                        hash = m->hash;
+
+                return journal_file_find_data_object_with_hash(f, m->data, m->size, hash, NULL, NULL);
+        }
+
+        if (m->type == MATCH_OR_TERM) {
+                LIST_FOREACH(matches, i, m->matches) {
+                        r = match_may_be_fulfilled(j, i, f);
+                        if (r != 0)
+                                return r;
+                }
+
+                return 0;
+        }
+
+        assert(m->type == MATCH_AND_TERM);
+
+        if (!m->matches)
+                return 0;
+
+        LIST_FOREACH(matches, i, m->matches) {
+                r = match_may_be_fulfilled(j, i, f);
+                if (r <= 0)
+                        return r;
+        }
+
+        return 1;
+}
+
 static int find_location_for_match(
                 sd_journal *j,
                 Match *m,
@@ -923,6 +970,51 @@ static int find_location_for_match(
         }
 }
 
+static bool location_is_out_of_range(sd_journal *j, JournalFile *f, direction_t direction) {
+        uint64_t seqnum, realtime;
+
+        assert(j);
+        assert(f);
+        assert(f->header);
+
+        /* Checks whether the seek target lies outside of the range of entries covered by the file, as
+         * recorded in its header, so that the file cannot contain any entry in the requested direction.
+         * The header is always mapped, hence this does not require touching any entry array. Without this
+         * check the bisection would have to visit the last (or first) item of entry arrays just to find
+         * nothing, which is costly when iterating over many archived files with "journalctl --since=",
+         * "--until=" or "--after-cursor=". The tail timestamp has already been refreshed by
+         * next_beyond_location(). */
+
+        if (j->current_location.type != LOCATION_SEEK)
+                return false;
+
+        /* Seeking by seqnum takes precedence, see find_location_with_matches() below. */
+        if (j->current_location.seqnum_set && sd_id128_equal(j->current_location.seqnum_id, f->header->seqnum_id)) {
+                if (direction == DIRECTION_DOWN) {
+                        seqnum = le64toh(READ_NOW(f->header->tail_entry_seqnum));
+                        return seqnum < j->current_location.seqnum;
+                }
+
+                seqnum = le64toh(READ_NOW(f->header->head_entry_seqnum));
+                return seqnum != 0 && seqnum > j->current_location.seqnum;
+        }
+
+        /* The monotonic timestamp is only comparable within the same boot, and we only know the boot ID of
+         * the tail entry, hence let's not try to be smart here. */
+        if (j->current_location.monotonic_set || !j->current_location.realtime_set)
+                return false;
+
+        if (direction == DIRECTION_DOWN) {
+                if (f->newest_entry_offset == 0)
+                        return false; /* Tail timestamp not known. */
+
+                return f->newest_realtime_usec < j->current_location.realtime;
+        }
+
+        realtime = le64toh(READ_NOW(f->header->head_entry_realtime));
+        return realtime != 0 && realtime > j->current_location.realtime;
+}
+
 static int find_location_with_matches(
                 sd_journal *j,
                 JournalFile *f,
@@ -935,8 +1027,16 @@ static int find_location_with_matches(
         assert(j);
         assert(f);
 
-        if (j->level0)
+        if (location_is_out_of_range(j, f, direction))
+                return 0;
+
+        if (j->level0) {
+                r = match_may_be_fulfilled(j, j->level0, f);
+                if (r <= 0)
+                        return r;
+
                 return find_location_for_match(j, j->level0, f, direction, ret, ret_offset);
+        }
 
         /* No matches is simple */
 
@@ -431,6 +431,54 @@ TEST(skip) {
         test_skip_one(setup_interleaved);
 }
 
+static void test_seek_realtime_one(void (*setup)(void)) {
+        _cleanup_(test_donep) char *t = NULL;
+        _cleanup_(sd_journal_closep) sd_journal *j = NULL;
+        usec_t realtime[9];
+
+        mkdtemp_chdir_chattr("/var/tmp/journal-seek-realtime-XXXXXX", &t);
+
+        setup();
+
+        ASSERT_OK(sd_journal_open_directory(&j, t, SD_JOURNAL_ASSUME_IMMUTABLE));
+
+        ASSERT_OK(sd_journal_seek_head(j));
+        for (unsigned i = 0; i < ELEMENTSOF(realtime); i++) {
+                ASSERT_OK_POSITIVE(sd_journal_next(j));
+                test_check_number(j, i + 1);
+                ASSERT_OK(sd_journal_get_realtime_usec(j, &realtime[i]));
+        }
+
+        /* Seeking to the timestamp of each entry must find that entry, regardless of which file it is in,
+         * and also when other files end before or start after the requested timestamp. */
+        for (unsigned i = 0; i < ELEMENTSOF(realtime); i++) {
+                ASSERT_OK(sd_journal_seek_realtime_usec(j, realtime[i]));
+                ASSERT_OK_POSITIVE(sd_journal_next(j));
+                test_check_number(j, i + 1);
+
+                ASSERT_OK(sd_journal_seek_realtime_usec(j, realtime[i]));
+                ASSERT_OK_POSITIVE(sd_journal_previous(j));
+                test_check_number(j, i + 1);
+        }
+
+        /* After the last entry of all files, nothing is left. */
+        ASSERT_OK(sd_journal_seek_realtime_usec(j, realtime[ELEMENTSOF(realtime) - 1] + 1));
+        ASSERT_OK_ZERO(sd_journal_next(j));
+        ASSERT_OK_POSITIVE(sd_journal_previous(j));
+        test_check_number(j, ELEMENTSOF(realtime));
+
+        /* Likewise, before the first entry of all files. */
+        ASSERT_OK(sd_journal_seek_realtime_usec(j, realtime[0] - 1));
+        ASSERT_OK_ZERO(sd_journal_previous(j));
+        ASSERT_OK_POSITIVE(sd_journal_next(j));
+        test_check_number(j, 1);
+}
+
+TEST(seek_realtime) {
+        test_seek_realtime_one(setup_sequential);
+        test_seek_realtime_one(setup_interleaved);
+}
+
 static void test_boot_id_one(void (*setup)(void), size_t n_ids_expected) {
         _cleanup_(test_donep) char *t = NULL;
         _cleanup_(sd_journal_closep) sd_journal *j = NULL;
@@ -10,11 +10,13 @@
 #include "mmap-cache.h"
 #include "tests.h"
 #include "tmpfile-util.h"
+#include "unaligned.h"
 
 int main(int argc, char *argv[]) {
-        MMapFileDescriptor *fx;
+        MMapFileDescriptor *fx, *fy;
         int x, y, z, r;
         char px[] = "/tmp/testmmapXXXXXXX", py[] = "/tmp/testmmapYXXXXXX", pz[] = "/tmp/testmmapZXXXXXX";
+        MMapCacheStats before, after;
         MMapCache *m;
         void *p, *q;
 
@@ -58,6 +60,55 @@ int main(int argc, char *argv[]) {
         assert_se((uint8_t*) p + 1 == (uint8_t*) q);
 
         mmap_cache_fd_free(fx);
+
+        /* Stream through a file front to back, which makes the cache map ahead with growing windows, and
+         * make sure we always get to see the right contents. */
+        uint64_t buf[512];
+        for (uint64_t i = 0; i < 48 * 1024 * 1024 / sizeof(buf); i++) {
+                for (size_t k = 0; k < ELEMENTSOF(buf); k++)
+                        buf[k] = i * ELEMENTSOF(buf) + k;
+                assert_se(write(y, buf, sizeof(buf)) == sizeof(buf));
+        }
+
+        assert_se(mmap_cache_add_fd(m, y, PROT_READ, &fy) > 0);
+
+        mmap_cache_get_stats(m, &before);
+
+        for (uint64_t i = 0; i < 48 * 1024 * 1024 / sizeof(uint64_t); i += 509) {
+                r = mmap_cache_fd_get(fy, 0, false, i * sizeof(uint64_t), sizeof(uint64_t), NULL, &p);
+                assert_se(r >= 0);
+                assert_se(unaligned_read_ne64(p) == i);
+        }
+
+        /* The first window is a regular one, all further ones must have been mapped ahead */
+        mmap_cache_get_stats(m, &after);
+        assert_se(after.n_missed_sequential > before.n_missed_sequential);
+        assert_se(after.n_missed - before.n_missed == after.n_missed_sequential - before.n_missed_sequential + 1);
+#if !ENABLE_DEBUG_MMAP_CACHE
+        /* Windows mapped ahead are at least as large as the regular 8 MiB ones, but don't waste half of
+         * that on data before the requested offset, hence we need at most as many of them as it takes to
+         * cover the file. */
+        assert_se(after.n_missed - before.n_missed <= 48 / 8);
+#endif
+
+        /* And jump around afterwards. */
+        for (uint64_t i = 48 * 1024 * 1024 / sizeof(uint64_t) - 1; i > 0; i /= 3) {
+                r = mmap_cache_fd_get(fy, 0, false, i * sizeof(uint64_t), sizeof(uint64_t), NULL, &p);
+                assert_se(r >= 0);
+                assert_se(unaligned_read_ne64(p) == i);
+        }
+
+        /* Dropping unused windows must not affect windows still in use. */
+        mmap_cache_trim(m);
+        assert_se(unaligned_read_ne64(p) == 1);
+
+        r = mmap_cache_fd_get(fy, 1, false, 4096 * sizeof(uint64_t), sizeof(uint64_t), NULL, &q);
+        assert_se(r >= 0);
+        assert_se(unaligned_read_ne64(q) == 4096);
+
+        mmap_cache_stats_log_debug(m);
+
+        mmap_cache_fd_free(fy);
         mmap_cache_unref(m);
 
         safe_close(x);
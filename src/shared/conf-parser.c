@@ -294,6 +294,7 @@ int config_parse(
         _cleanup_fclose_ FILE *ours = NULL;
         unsigned line = 0, section_line = 0;
         bool section_ignored = false, bom_seen = false;
+        ReadLineFlags read_flags = 0;
         struct stat st;
         int r, fd;
 
@@ -328,6 +329,11 @@ int config_parse(
                                               "Failed to fstat(%s): %m", filename);
 
                 (void) stat_warn_permissions(filename, &st);
+
+                /* Only character devices can be TTYs. Let read_line_full() know if we are not reading from
+                 * one, so that it doesn't have to check that again for every single line. */
+                if (!S_ISCHR(st.st_mode))
+                        read_flags |= READ_LINE_NOT_A_TTY;
         } else
                 st = (struct stat) {};
 
@@ -336,7 +342,7 @@ int config_parse(
                 bool escaped = false;
                 char *l, *p, *e;
 
-                r = read_line(f, LONG_LINE_MAX, &buf);
+                r = read_line_full(f, LONG_LINE_MAX, read_flags, &buf);
                 if (r == 0)
                         break;
                 if (r == -ENOBUFS) {
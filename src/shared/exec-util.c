@@ -30,6 +30,7 @@
 #include "string-util.h"
 #include "strv.h"
 #include "terminal-util.h"
+#include "time-util.h"
 #include "tmpfile-util.h"
 
 #define EXIT_SKIP_REMAINING 77
@@ -101,6 +102,7 @@ static int do_execute(
 
         _cleanup_hashmap_free_free_ Hashmap *pids = NULL;
         bool parallel_execution;
+        usec_t start;
         int r;
 
         /* We fork this all off from a child process so that we can somewhat cleanly make
@@ -127,6 +129,8 @@ static int do_execute(
                 if (putenv(*e) != 0)
                         return log_error_errno(errno, "Failed to set environment variable: %m");
 
+        start = now(CLOCK_MONOTONIC);
+
         STRV_FOREACH(path, paths) {
                 _cleanup_free_ char *t = NULL;
                 _cleanup_close_ int fd = -EBADF;
@@ -167,10 +171,15 @@ static int do_execute(
                         t = NULL;
                 } else {
                         bool skip_remaining = false;
+                        usec_t n;
 
+                        n = now(CLOCK_MONOTONIC);
                         r = wait_for_terminate_and_check(t, pid, WAIT_LOG_ABNORMAL);
                         if (r < 0)
                                 return r;
+
+                        log_debug("%s finished after %s.", t,
+                                  FORMAT_TIMESPAN(usec_sub_unsigned(now(CLOCK_MONOTONIC), n), USEC_PER_MSEC));
                         if (r > 0) {
                                 if (FLAGS_SET(flags, EXEC_DIR_SKIP_REMAINING) && r == EXIT_SKIP_REMAINING) {
                                         log_info("%s succeeded with exit status %i, not executing remaining executables.", *path, r);
@@ -205,17 +214,34 @@ static int do_execute(
 
         while (!hashmap_isempty(pids)) {
                 _cleanup_free_ char *t = NULL;
+                siginfo_t si = {};
                 pid_t pid;
 
-                pid = PTR_TO_PID(hashmap_first_key(pids));
+                /* Collect the processes in the order they finish, without reaping them yet, so that we
+                 * can tell how long each of them took. They were all spawned at about the same time. */
+                if (waitid(P_ALL, 0, &si, WEXITED|WNOWAIT) < 0) {
+                        if (errno == EINTR)
+                                continue;
+
+                        return log_error_errno(errno, "Failed to wait for child processes: %m");
+                }
+
+                pid = si.si_pid;
                 assert(pid > 0);
 
                 t = hashmap_remove(pids, PID_TO_PTR(pid));
-                assert(t);
+                if (!t) {
+                        /* Not one of ours, just reap it. */
+                        (void) wait_for_terminate(pid, NULL);
+                        continue;
+                }
 
                 r = wait_for_terminate_and_check(t, pid, WAIT_LOG);
                 if (r < 0)
                         return r;
+
+                log_debug("%s finished after %s.", t,
+                          FORMAT_TIMESPAN(usec_sub_unsigned(now(CLOCK_MONOTONIC), start), USEC_PER_MSEC));
                 if (!FLAGS_SET(flags, EXEC_DIR_IGNORE_ERRORS) && r > 0)
                         return r;
         }
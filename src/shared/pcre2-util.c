@@ -11,6 +11,7 @@ DLSYM_PROTOTYPE(pcre2_match_data_create) = NULL;
 DLSYM_PROTOTYPE(pcre2_match_data_free) = NULL;
 DLSYM_PROTOTYPE(pcre2_code_free) = NULL;
 DLSYM_PROTOTYPE(pcre2_compile) = NULL;
+DLSYM_PROTOTYPE(pcre2_jit_compile) = NULL;
 DLSYM_PROTOTYPE(pcre2_get_error_message) = NULL;
 DLSYM_PROTOTYPE(pcre2_match) = NULL;
 DLSYM_PROTOTYPE(pcre2_get_ovector_pointer) = NULL;
@@ -46,6 +47,7 @@ int dlopen_pcre2(void) {
                         DLSYM_ARG(pcre2_match_data_free),
                         DLSYM_ARG(pcre2_code_free),
                         DLSYM_ARG(pcre2_compile),
+                        DLSYM_ARG(pcre2_jit_compile),
                         DLSYM_ARG(pcre2_get_error_message),
                         DLSYM_ARG(pcre2_match),
                         DLSYM_ARG(pcre2_get_ovector_pointer));
@@ -54,13 +56,54 @@ int dlopen_pcre2(void) {
 #endif
 }
 
-int pattern_compile_and_log(const char *pattern, PatternCompileCase case_, pcre2_code **ret) {
 #if HAVE_PCRE2
+static int pattern_compile_internal(const char *pattern, unsigned flags, bool jit, pcre2_code **ret) {
         PCRE2_SIZE erroroffset;
         _cleanup_(sym_pcre2_code_freep) pcre2_code *p = NULL;
-        unsigned flags = 0;
         int errorcode, r;
 
+        assert(pattern);
+        assert(ret);
+
+        p = sym_pcre2_compile((PCRE2_SPTR8) pattern,
+                              PCRE2_ZERO_TERMINATED, flags, &errorcode, &erroroffset, NULL);
+        if (!p) {
+                unsigned char buf[LINE_MAX];
+
+                r = sym_pcre2_get_error_message(errorcode, buf, sizeof buf);
+
+                return log_error_errno(SYNTHETIC_ERRNO(EINVAL),
+                                       "Bad pattern \"%s\": %s", pattern,
+                                       r < 0 ? "unknown error" : (char *)buf);
+        }
+
+        /* Compile the pattern to machine code if possible, which speeds up matching considerably, e.g. when
+         * grepping through a large number of journal entries. If JIT support is not available on this
+         * architecture, in this build of PCRE2, or because we run with MemoryDenyWriteExecute=yes,
+         * pcre2_match() simply uses the interpreter. */
+        if (jit) {
+                r = sym_pcre2_jit_compile(p, PCRE2_JIT_COMPLETE);
+                if (r < 0) {
+                        unsigned char buf[LINE_MAX];
+                        int k;
+
+                        k = sym_pcre2_get_error_message(r, buf, sizeof buf);
+                        log_debug("JIT compilation of pattern \"%s\" failed, using interpreter: %s",
+                                  pattern, k < 0 ? "unknown error" : (char*) buf);
+                }
+        }
+
+        *ret = TAKE_PTR(p);
+        return 0;
+}
+#endif
+
+int pattern_compile_and_log(const char *pattern, PatternCompileCase case_, pcre2_code **ret) {
+#if HAVE_PCRE2
+        _cleanup_(sym_pcre2_code_freep) pcre2_code *p = NULL;
+        unsigned flags = 0;
+        int r;
+
         assert(pattern);
 
         r = dlopen_pcre2();
@@ -78,7 +121,8 @@ int pattern_compile_and_log(const char *pattern, PatternCompileCase case_, pcre2
                 if (!md)
                         return log_oom();
 
-                r = pattern_compile_and_log("[[:upper:]]", PATTERN_COMPILE_CASE_SENSITIVE, &cs);
+                /* Used for a single match only, not worth JIT compiling */
+                r = pattern_compile_internal("[[:upper:]]", 0, /* jit= */ false, &cs);
                 if (r < 0)
                         return r;
 
@@ -92,17 +136,11 @@ int pattern_compile_and_log(const char *pattern, PatternCompileCase case_, pcre2
                   flags & PCRE2_CASELESS ? "insensitive" : "sensitive",
                   case_ != PATTERN_COMPILE_CASE_AUTO ? "request" : "pattern casing");
 
-        p = sym_pcre2_compile((PCRE2_SPTR8) pattern,
-                              PCRE2_ZERO_TERMINATED, flags, &errorcode, &erroroffset, NULL);
-        if (!p) {
-                unsigned char buf[LINE_MAX];
-
-                r = sym_pcre2_get_error_message(errorcode, buf, sizeof buf);
-
-                return log_error_errno(SYNTHETIC_ERRNO(EINVAL),
-                                       "Bad pattern \"%s\": %s", pattern,
-                                       r < 0 ? "unknown error" : (char *)buf);
-        }
+        /* Only JIT compile the pattern if the caller actually wants to match against it, and not just
+         * validate it */
+        r = pattern_compile_internal(pattern, flags, /* jit= */ !!ret, &p);
+        if (r < 0)
+                return r;
 
         if (ret)
                 *ret = TAKE_PTR(p);
@@ -135,6 +173,17 @@ int pattern_matches_and_log(pcre2_code *compiled_pattern, const char *message, s
                             0,      /* default options */
                             md,
                             NULL);
+        if (r == PCRE2_ERROR_JIT_STACKLIMIT)
+                /* The JIT code runs on a small fixed-size stack, which complex patterns can exhaust on long
+                 * messages. The interpreter keeps its backtracking state on the heap, hence retry with
+                 * that. */
+                r = sym_pcre2_match(compiled_pattern,
+                                    (const unsigned char *)message,
+                                    size,
+                                    0,
+                                    PCRE2_NO_JIT,
+                                    md,
+                                    NULL);
         if (r == PCRE2_ERROR_NOMATCH)
                 return false;
         if (r < 0) {
@@ -316,7 +316,9 @@ int deserialize_read_line(FILE *f, char **ret) {
         assert(f);
         assert(ret);
 
-        r = read_stripped_line(f, LONG_LINE_MAX, &line);
+        /* Serialization data always comes from a memfd or a regular file, never from a TTY. Say so
+         * explicitly, so that read_line_full() doesn't have to issue an isatty() check for every line. */
+        r = read_stripped_line_full(f, LONG_LINE_MAX, READ_LINE_NOT_A_TTY, &line);
         if (r < 0)
                 return log_error_errno(r, "Failed to read serialization line: %m");
         if (r == 0) { /* eof */